@@ -0,0 +1,84 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+/**
+ * @class BoundedQueue
+ * @brief Fixed-capacity blocking queue connecting pipeline stages
+ *
+ * push() blocks while the queue is full, so a fast producer cannot run ahead
+ * of a slow consumer by more than the capacity. pop() blocks while the queue
+ * is empty and returns nothing once the queue is closed and drained.
+ *
+ * @tparam T Item type (must be movable)
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    /**
+     * @brief Constructor for the queue
+     * @param capacity Maximum number of queued items (at least 1)
+     */
+    explicit BoundedQueue(std::size_t capacity)
+        : capacity(capacity == 0 ? 1 : capacity), closed(false) {}
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * @brief Add an item, waiting for space if the queue is full
+     * @param item Item to add
+     * @return false if the queue was closed (the item is dropped)
+     */
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this]() { return items.size() < capacity || closed; });
+        if (closed) {
+            return false;
+        }
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest item, waiting if the queue is empty
+     * @return The item, or nothing if the queue is closed and empty
+     */
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this]() { return !items.empty() || closed; });
+        if (items.empty()) {
+            return std::nullopt;
+        }
+        T item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return item;
+    }
+
+    /**
+     * @brief Stop accepting items; consumers drain what is left, then stop
+     */
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+
+private:
+    std::size_t capacity;
+    bool closed;
+    std::deque<T> items;
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+};
+
+#endif // BOUNDED_QUEUE_H
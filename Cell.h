@@ -35,10 +35,13 @@ public:
     bool isVisited() const { return visited; }
 
     // Setters
-    void setType(CellType newType) { type = newType; }
     void setVisited(bool v) { visited = v; }
 
 private:
+    // Type changes go through Maze::setCellType() so the maze content hash stays current
+    friend class Maze;
+    void setType(CellType newType) { type = newType; }
+
     int row;
     int col;
     CellType type;
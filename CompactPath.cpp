@@ -0,0 +1,50 @@
+#include "CompactPath.h"
+
+CompactPath::CompactPath(int startRow, int startCol, std::size_t steps)
+    : hasStart(true), startRow(startRow), startCol(startCol), steps(steps),
+      moves((steps + 3) / 4, 0) {}
+
+CompactPath::CompactPath(int startRow, int startCol, std::size_t steps,
+                         std::vector<std::uint8_t> packed)
+    : hasStart(true), startRow(startRow), startCol(startCol), steps(steps),
+      moves(std::move(packed)) {
+    moves.resize((steps + 3) / 4, 0);
+
+    // Clear unused bits in the last byte so equal paths compare equal
+    if ((steps & 3) != 0) {
+        moves.back() &= static_cast<std::uint8_t>((1 << ((steps & 3) * 2)) - 1);
+    }
+}
+
+void CompactPath::setMove(std::size_t i, Move move) {
+    std::uint8_t& byte = moves[i >> 2];
+    int shift = static_cast<int>(i & 3) * 2;
+    byte = static_cast<std::uint8_t>((byte & ~(3 << shift)) | (move << shift));
+}
+
+void CompactPath::append(Move move) {
+    if ((steps & 3) == 0) {
+        moves.push_back(0);
+    }
+    ++steps;
+    setMove(steps - 1, move);
+}
+
+int CompactPath::moveFromDelta(int dRow, int dCol) {
+    if (dRow == -1 && dCol == 0) return UP;
+    if (dRow == 1 && dCol == 0) return DOWN;
+    if (dRow == 0 && dCol == -1) return LEFT;
+    if (dRow == 0 && dCol == 1) return RIGHT;
+    return -1;
+}
+
+bool CompactPath::operator==(const CompactPath& other) const {
+    if (hasStart != other.hasStart) {
+        return false;
+    }
+    if (!hasStart) {
+        return true;
+    }
+    return startRow == other.startRow && startCol == other.startCol &&
+           steps == other.steps && moves == other.moves;
+}
@@ -0,0 +1,153 @@
+#ifndef COMPACT_PATH_H
+#define COMPACT_PATH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ * @class CompactPath
+ * @brief A path through the maze stored as a start cell plus 2-bit moves
+ *
+ * Each step between adjacent cells is one of four moves, so a path of n cells
+ * needs 2 * (n - 1) bits instead of 8 bytes per cell. Coordinates are produced
+ * lazily by the iterator; size() is O(1).
+ *
+ * An empty path (size() == 0) means "no path"; a path whose start is also its
+ * end has size() == 1 and no moves.
+ */
+class CompactPath {
+public:
+    /**
+     * @brief Move codes, in the same order as the direction tables elsewhere
+     */
+    enum Move : std::uint8_t {
+        UP = 0,
+        DOWN = 1,
+        LEFT = 2,
+        RIGHT = 3
+    };
+
+    /**
+     * @class const_iterator
+     * @brief Walks the path, yielding (row, col) for each cell
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::pair<int, int>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = value_type;
+
+        const_iterator(const CompactPath* path, std::size_t index, int row, int col)
+            : path(path), index(index), cell(row, col) {}
+
+        value_type operator*() const { return cell; }
+        pointer operator->() const { return &cell; }
+
+        const_iterator& operator++() {
+            if (index < path->steps) {
+                Move move = path->getMove(index);
+                cell.first += rowDelta(move);
+                cell.second += colDelta(move);
+            }
+            ++index;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const { return index == other.index; }
+        bool operator!=(const const_iterator& other) const { return index != other.index; }
+
+    private:
+        const CompactPath* path;
+        std::size_t index;
+        value_type cell;
+    };
+
+    /**
+     * @brief Construct an empty path (no solution)
+     */
+    CompactPath() : hasStart(false), startRow(0), startCol(0), steps(0) {}
+
+    /**
+     * @brief Construct a path with a known number of moves, all initially UP
+     *
+     * Lets a writer fill moves in any order with setMove(), e.g. back to front
+     * while following parent pointers.
+     *
+     * @param startRow Start cell row
+     * @param startCol Start cell column
+     * @param steps Number of moves
+     */
+    CompactPath(int startRow, int startCol, std::size_t steps);
+
+    /**
+     * @brief Construct a path from already packed moves (4 per byte, lowest bits first)
+     * @param startRow Start cell row
+     * @param startCol Start cell column
+     * @param steps Number of moves
+     * @param packed Packed move bytes; must hold at least (steps + 3) / 4 bytes
+     */
+    CompactPath(int startRow, int startCol, std::size_t steps, std::vector<std::uint8_t> packed);
+
+    // Size and endpoints
+    std::size_t size() const { return hasStart ? steps + 1 : 0; }
+    bool empty() const { return !hasStart; }
+    std::size_t getStepCount() const { return steps; }
+    int getStartRow() const { return startRow; }
+    int getStartCol() const { return startCol; }
+
+    // Move access
+    Move getMove(std::size_t i) const {
+        return static_cast<Move>((moves[i >> 2] >> ((i & 3) * 2)) & 3);
+    }
+    void setMove(std::size_t i, Move move);
+
+    /**
+     * @brief Append one move at the end of the path (the path must not be empty)
+     * @param move Move from the current last cell
+     */
+    void append(Move move);
+
+    /**
+     * @brief Get the packed move bytes for serialization
+     * @return (getStepCount() + 3) / 4 bytes, 4 moves per byte, lowest bits first
+     */
+    const std::vector<std::uint8_t>& getPackedMoves() const { return moves; }
+
+    /**
+     * @brief Get the move code for a single step between adjacent cells
+     * @param dRow Row difference (-1, 0 or 1)
+     * @param dCol Column difference (-1, 0 or 1)
+     * @return Move code, or -1 if the step is not an up/down/left/right move
+     */
+    static int moveFromDelta(int dRow, int dCol);
+
+    static int rowDelta(Move move) { return move == UP ? -1 : (move == DOWN ? 1 : 0); }
+    static int colDelta(Move move) { return move == LEFT ? -1 : (move == RIGHT ? 1 : 0); }
+
+    // Iteration
+    const_iterator begin() const { return const_iterator(this, 0, startRow, startCol); }
+    const_iterator end() const { return const_iterator(this, size(), 0, 0); }
+
+    bool operator==(const CompactPath& other) const;
+    bool operator!=(const CompactPath& other) const { return !(*this == other); }
+
+private:
+    bool hasStart;
+    int startRow;
+    int startCol;
+    std::size_t steps;
+    std::vector<std::uint8_t> moves;
+};
+
+#endif // COMPACT_PATH_H
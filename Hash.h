@@ -0,0 +1,22 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstdint>
+
+/**
+ * @brief SplitMix64 finalizer: cheap, well-mixed hash of a 64-bit value
+ *
+ * Used for the maze content hash, the solve-cache key hash and the
+ * post-processor's per-cell random decisions.
+ *
+ * @param x Value to mix
+ * @return Mixed 64-bit value
+ */
+inline std::uint64_t mix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+#endif // HASH_H
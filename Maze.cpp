@@ -1,4 +1,5 @@
 #include "Maze.h"
+#include "Hash.h"
 #include <algorithm>
 
 Maze::Maze(int rows, int cols)
@@ -11,10 +12,7 @@ Maze::Maze(int rows, int cols)
             grid[i][j] = Cell(i, j, Cell::WALL);
         }
     }
-}
-
-Cell& Maze::getCell(int row, int col) {
-    return grid[row][col];
+    contentHash = baseHash();
 }
 
 const Cell& Maze::getCell(int row, int col) const {
@@ -28,6 +26,24 @@ void Maze::reset() {
             grid[i][j].setVisited(false);
         }
     }
+    contentHash = baseHash();
+}
+
+void Maze::setCellType(int row, int col, Cell::CellType type) {
+    Cell& cell = grid[row][col];
+    if (cell.getType() != type) {
+        // Toggling a cell between WALL and PATH flips its key in or out of the hash
+        contentHash ^= cellKey(row, col);
+        cell.setType(type);
+    }
+}
+
+std::uint64_t Maze::baseHash() const {
+    return mix64((static_cast<std::uint64_t>(rows) << 32) ^ static_cast<std::uint32_t>(cols));
+}
+
+std::uint64_t Maze::cellKey(int row, int col) const {
+    return mix64(static_cast<std::uint64_t>(row) * static_cast<std::uint64_t>(cols) + col);
 }
 
 bool Maze::isInBounds(int row, int col) const {
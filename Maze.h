@@ -4,6 +4,7 @@
 #include "Cell.h"
 #include <vector>
 #include <utility>
+#include <cstdint>
 
 /**
  * @class Maze
@@ -24,9 +25,35 @@ public:
     // Getters
     int getRows() const { return rows; }
     int getCols() const { return cols; }
-    Cell& getCell(int row, int col);
     const Cell& getCell(int row, int col) const;
 
+    /**
+     * @brief Get the content hash of the grid
+     *
+     * The hash covers the dimensions and the type of every cell, and is kept up
+     * to date incrementally by setCellType(), the only way to change a cell's type
+     * (getCell() returns a const reference).
+     *
+     * @return 64-bit hash identifying the maze layout
+     */
+    std::uint64_t getContentHash() const { return contentHash; }
+
+    /**
+     * @brief Set the type of a cell and update the content hash
+     * @param row Row coordinate
+     * @param col Column coordinate
+     * @param type New cell type
+     */
+    void setCellType(int row, int col, Cell::CellType type);
+
+    /**
+     * @brief Set the visited flag of a cell (scratch state for algorithms, not hashed)
+     * @param row Row coordinate
+     * @param col Column coordinate
+     * @param visited New visited state
+     */
+    void setCellVisited(int row, int col, bool visited) { grid[row][col].setVisited(visited); }
+
     // Grid operations
     /**
      * @brief Reset all cells to walls and unvisited state
@@ -61,6 +88,21 @@ private:
     int rows;
     int cols;
     std::vector<std::vector<Cell>> grid;
+    std::uint64_t contentHash;
+
+    /**
+     * @brief Hash of an all-wall grid with these dimensions
+     * @return Base value the PATH cell keys are combined into
+     */
+    std::uint64_t baseHash() const;
+
+    /**
+     * @brief Per-cell key; the content hash is the XOR of keys of all PATH cells
+     * @param row Row coordinate
+     * @param col Column coordinate
+     * @return 64-bit key for the cell position
+     */
+    std::uint64_t cellKey(int row, int col) const;
 };
 
 #endif // MAZE_H
@@ -0,0 +1,142 @@
+#include "MazeAnalyzer.h"
+#include <algorithm>
+#include <thread>
+
+MazeAnalyzer::MazeAnalyzer(unsigned int threadCount)
+    : threadCount(threadCount) {
+    if (this->threadCount == 0) {
+        this->threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+ConnectivityReport MazeAnalyzer::analyze(const Maze& maze) const {
+    const int rows = maze.getRows();
+    const int cols = maze.getCols();
+    const std::size_t cellCount = static_cast<std::size_t>(rows) * cols;
+
+    // noParent marks a wall; PATH cells start as their own root.
+    // Indices are size_t so grids beyond 2^31 cells stay well-defined.
+    std::vector<std::size_t> parent(cellCount, noParent);
+
+    // Split rows into strips, never more strips than rows
+    int strips = static_cast<int>(std::min<unsigned int>(threadCount, static_cast<unsigned int>(rows)));
+    if (strips < 1) strips = 1;
+
+    std::vector<int> bounds(strips + 1);
+    for (int s = 0; s <= strips; ++s) {
+        bounds[s] = static_cast<int>(static_cast<long long>(rows) * s / strips);
+    }
+
+    std::vector<std::size_t> stripEdges(strips, 0);
+
+    if (strips == 1) {
+        stripEdges[0] = labelStrip(maze, parent, 0, rows);
+    } else {
+        // Each strip only reads and writes parent entries for its own rows,
+        // so strips can be labeled concurrently without synchronization
+        std::vector<std::thread> workers;
+        workers.reserve(strips);
+        for (int s = 0; s < strips; ++s) {
+            workers.emplace_back([&, s]() {
+                stripEdges[s] = labelStrip(maze, parent, bounds[s], bounds[s + 1]);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    ConnectivityReport report;
+    report.cols = cols;
+    for (std::size_t e : stripEdges) {
+        report.edges += e;
+    }
+
+    // Merge seams: join the first row of each strip with the row above it
+    for (int s = 1; s < strips; ++s) {
+        std::size_t rowStart = static_cast<std::size_t>(bounds[s]) * cols;
+        for (int j = 0; j < cols; ++j) {
+            std::size_t index = rowStart + j;
+            if (parent[index] != noParent && parent[index - cols] != noParent) {
+                unite(parent, index, index - cols);
+                report.edges++;
+            }
+        }
+    }
+
+    // Final scan: assign dense region ids in row-major order and count sizes
+    report.labels.assign(cellCount, -1);
+    for (std::size_t i = 0; i < cellCount; ++i) {
+        if (parent[i] == noParent) {
+            continue;
+        }
+        std::size_t root = findRoot(parent, i);
+        if (report.labels[root] == -1) {
+            report.labels[root] = static_cast<std::int64_t>(report.regionCount++);
+            report.regionSizes.push_back(0);
+        }
+        std::int64_t region = report.labels[root];
+        report.labels[i] = region;
+        report.regionSizes[region]++;
+        report.pathCells++;
+    }
+
+    // Cyclomatic number: each region is a spanning tree plus one edge per loop
+    report.loops = report.edges + report.regionCount - report.pathCells;
+    report.perfect = report.regionCount == 1 && report.loops == 0;
+
+    return report;
+}
+
+std::size_t MazeAnalyzer::findRoot(std::vector<std::size_t>& parent, std::size_t index) {
+    while (parent[index] != index) {
+        parent[index] = parent[parent[index]];
+        index = parent[index];
+    }
+    return index;
+}
+
+void MazeAnalyzer::unite(std::vector<std::size_t>& parent, std::size_t a, std::size_t b) {
+    std::size_t rootA = findRoot(parent, a);
+    std::size_t rootB = findRoot(parent, b);
+    if (rootA == rootB) {
+        return;
+    }
+    // Keep the smaller index as root so roots stay at each region's first cell
+    if (rootA < rootB) {
+        parent[rootB] = rootA;
+    } else {
+        parent[rootA] = rootB;
+    }
+}
+
+std::size_t MazeAnalyzer::labelStrip(const Maze& maze, std::vector<std::size_t>& parent,
+                                     int firstRow, int lastRow) {
+    const int cols = maze.getCols();
+    std::size_t edges = 0;
+
+    for (int i = firstRow; i < lastRow; ++i) {
+        for (int j = 0; j < cols; ++j) {
+            if (maze.getCell(i, j).getType() != Cell::PATH) {
+                continue;
+            }
+
+            std::size_t index = static_cast<std::size_t>(i) * cols + j;
+            parent[index] = index;
+
+            // Join with the left neighbor
+            if (j > 0 && parent[index - 1] != noParent) {
+                unite(parent, index, index - 1);
+                edges++;
+            }
+
+            // Join with the neighbor above, if it belongs to this strip
+            if (i > firstRow && parent[index - cols] != noParent) {
+                unite(parent, index, index - cols);
+                edges++;
+            }
+        }
+    }
+
+    return edges;
+}
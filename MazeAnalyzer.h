@@ -0,0 +1,115 @@
+#ifndef MAZE_ANALYZER_H
+#define MAZE_ANALYZER_H
+
+#include "Maze.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct ConnectivityReport
+ * @brief Result of a connected-component labeling pass over a maze
+ *
+ * Regions are groups of PATH cells connected through up/down/left/right moves.
+ * Region ids are dense (0 .. regionCount - 1) and numbered in row-major order
+ * of each region's first cell, so the report is identical for any thread count.
+ */
+struct ConnectivityReport {
+    std::size_t regionCount = 0;         ///< Number of connected PATH regions
+    std::vector<std::size_t> regionSizes; ///< Cell count of each region, indexed by region id
+    std::size_t pathCells = 0;           ///< Total number of PATH cells
+    std::size_t edges = 0;               ///< Number of adjacent PATH-PATH pairs
+    std::size_t loops = 0;               ///< Independent cycles (edges - pathCells + regionCount)
+    bool perfect = false;                ///< Exactly one region and no loops
+
+    /**
+     * @brief Region id of every cell in row-major order (-1 for walls)
+     *
+     * Lets callers answer any number of start/end connectivity questions in O(1)
+     * after a single scan, instead of running one BFS per question.
+     */
+    std::vector<std::int64_t> labels;
+    int cols = 0;
+
+    /**
+     * @brief Get the region id of a cell
+     * @param row Row coordinate
+     * @param col Column coordinate
+     * @return Region id, or -1 if the cell is a wall
+     */
+    std::int64_t regionOf(int row, int col) const {
+        return labels[static_cast<std::size_t>(row) * cols + col];
+    }
+
+    /**
+     * @brief Check if two cells belong to the same region
+     * @return true if both cells are PATH cells in the same region
+     */
+    bool connected(int row1, int col1, int row2, int col2) const {
+        std::int64_t a = regionOf(row1, col1);
+        return a != -1 && a == regionOf(row2, col2);
+    }
+};
+
+/**
+ * @class MazeAnalyzer
+ * @brief Validates maze structure using union-find connected-component labeling
+ *
+ * Performs one row-major scan over the grid, joining each PATH cell with its
+ * PATH neighbors above and to the left. This labels every region at once and
+ * counts edges, which is enough to detect loops and isolated areas left behind
+ * by post-processing (removing or adding walls).
+ *
+ * With more than one thread the grid is split into horizontal strips that are
+ * labeled independently; strip seams are then merged in a short serial pass.
+ */
+class MazeAnalyzer {
+public:
+    /**
+     * @brief Constructor for the analyzer
+     * @param threadCount Number of worker threads (0 = hardware concurrency, 1 = serial)
+     */
+    explicit MazeAnalyzer(unsigned int threadCount = 1);
+
+    /**
+     * @brief Label all regions and compute structural statistics
+     * @param maze Reference to the maze to analyze
+     * @return Connectivity report for the whole grid
+     */
+    ConnectivityReport analyze(const Maze& maze) const;
+
+private:
+    unsigned int threadCount;
+
+    // Parent entry for wall cells, which belong to no set
+    static constexpr std::size_t noParent = SIZE_MAX;
+
+    /**
+     * @brief Find the root of a union-find set (with path halving)
+     * @param parent Parent array
+     * @param index Cell index
+     * @return Root index of the set containing the cell
+     */
+    static std::size_t findRoot(std::vector<std::size_t>& parent, std::size_t index);
+
+    /**
+     * @brief Merge the sets containing two cells
+     * @param parent Parent array
+     * @param a First cell index
+     * @param b Second cell index
+     */
+    static void unite(std::vector<std::size_t>& parent, std::size_t a, std::size_t b);
+
+    /**
+     * @brief Label a horizontal strip of rows, ignoring cells outside the strip
+     * @param maze Reference to the maze
+     * @param parent Parent array (only entries inside the strip are written)
+     * @param firstRow First row of the strip
+     * @param lastRow One past the last row of the strip
+     * @return Number of PATH-PATH edges inside the strip
+     */
+    static std::size_t labelStrip(const Maze& maze, std::vector<std::size_t>& parent,
+                                  int firstRow, int lastRow);
+};
+
+#endif // MAZE_ANALYZER_H
@@ -21,21 +21,21 @@ bool MazeGenerator::generateMaze(Maze& maze) {
     int startCol = 0;
 
     // Mark start cell as path
-    maze.getCell(startRow, startCol).setType(Cell::PATH);
-    maze.getCell(startRow, startCol).setVisited(true);
+    maze.setCellType(startRow, startCol, Cell::PATH);
+    maze.setCellVisited(startRow, startCol, true);
 
     // Begin recursive backtracking
     recursiveBacktrack(maze, startRow, startCol);
 
     // Ensure end cell is a path
-    maze.getCell(maze.getRows() - 1, maze.getCols() - 1).setType(Cell::PATH);
+    maze.setCellType(maze.getRows() - 1, maze.getCols() - 1, Cell::PATH);
 
     return true;
 }
 
 void MazeGenerator::recursiveBacktrack(Maze& maze, int row, int col) {
     // Mark current cell as visited
-    maze.getCell(row, col).setVisited(true);
+    maze.setCellVisited(row, col, true);
 
     // Directions: up, down, left, right (moving by 2 cells)
     const int directions[4][2] = { {-2, 0}, {2, 0}, {0, -2}, {0, 2} };
@@ -55,8 +55,8 @@ void MazeGenerator::recursiveBacktrack(Maze& maze, int row, int col) {
             int wallRow = row + directions[dirIdx][0] / 2;
             int wallCol = col + directions[dirIdx][1] / 2;
             
-            maze.getCell(wallRow, wallCol).setType(Cell::PATH);
-            maze.getCell(newRow, newCol).setType(Cell::PATH);
+            maze.setCellType(wallRow, wallCol, Cell::PATH);
+            maze.setCellType(newRow, newCol, Cell::PATH);
 
             // Recursively carve from the new cell
             recursiveBacktrack(maze, newRow, newCol);
@@ -71,6 +71,6 @@ void MazeGenerator::shuffleNeighbors(std::vector<std::pair<int, int>>& neighbors
 
 void MazeGenerator::carvePath(Maze& maze, int row1, int col1, int row2, int col2) {
     // This method is used internally during generation
-    maze.getCell(row1, col1).setType(Cell::PATH);
-    maze.getCell(row2, col2).setType(Cell::PATH);
+    maze.setCellType(row1, col1, Cell::PATH);
+    maze.setCellType(row2, col2, Cell::PATH);
 }
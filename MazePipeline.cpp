@@ -0,0 +1,196 @@
+#include "MazePipeline.h"
+#include "BoundedQueue.h"
+#include "Maze.h"
+#include "MazeGenerator.h"
+#include "MazeSolver.h"
+#include "MazeRenderer.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// A generated maze waiting to be solved
+struct SolveJob {
+    int index;
+    unsigned int seed;
+    Maze maze;
+};
+
+// A rendered maze waiting to be written
+struct WriteJob {
+    int index;
+    std::string text;
+};
+
+double elapsedMs(Clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+}
+
+} // namespace
+
+MazePipeline::MazePipeline(const PipelineConfig& config)
+    : config(config) {
+    if (this->config.seed == 0) {
+        // Use current time as the base seed for randomness
+        this->config.seed = static_cast<unsigned int>(
+            std::chrono::system_clock::now().time_since_epoch().count()
+        );
+        if (this->config.seed == 0) {
+            this->config.seed = 1;
+        }
+    }
+    if (this->config.generatorThreads == 0) {
+        this->config.generatorThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+PipelineStats MazePipeline::run() {
+    PipelineStats stats;
+    auto wallStart = Clock::now();
+
+    // Open the output before starting any work
+    std::ofstream file;
+    std::ostream* out = &std::cout;
+    if (!config.outputPath.empty()) {
+        file.open(config.outputPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            stats.ok = false;
+            return stats;
+        }
+        out = &file;
+    }
+
+    const int rows = config.rows;
+    const int cols = config.cols;
+    const int mazeCount = std::max(0, config.mazeCount);
+    const unsigned int generators = std::max(1u,
+        std::min(config.generatorThreads, static_cast<unsigned int>(std::max(1, mazeCount))));
+
+    BoundedQueue<SolveJob> solveQueue(config.queueCapacity);
+    BoundedQueue<WriteJob> writeQueue(config.queueCapacity);
+
+    // Limit how far generation may run ahead of the writer. Every maze between
+    // the next one to write and this window is either queued, being worked on,
+    // or held in the writer's reorder buffer, so that buffer stays bounded too.
+    const int window = static_cast<int>(generators + 2 * std::max<std::size_t>(1, config.queueCapacity));
+    std::mutex windowMutex;
+    std::condition_variable windowOpen;
+    int written = 0;
+
+    // Stage 1: generator threads claim maze indices until the batch is done
+    std::atomic<int> nextIndex(0);
+    std::vector<double> generateBusy(generators, 0.0);
+    std::vector<std::thread> generatorThreads;
+    generatorThreads.reserve(generators);
+    for (unsigned int g = 0; g < generators; ++g) {
+        generatorThreads.emplace_back([&, g]() {
+            for (int index = nextIndex++; index < mazeCount; index = nextIndex++) {
+                {
+                    // Indices are claimed in order, so the next maze to write is
+                    // always inside the window and this wait cannot deadlock
+                    std::unique_lock<std::mutex> lock(windowMutex);
+                    windowOpen.wait(lock, [&]() { return index < written + window; });
+                }
+
+                auto start = Clock::now();
+                unsigned int seed = mazeSeed(index);
+                Maze maze(rows, cols);
+                MazeGenerator generator(seed);
+                generator.generateMaze(maze);
+                generateBusy[g] += elapsedMs(start);
+
+                if (!solveQueue.push(SolveJob{ index, seed, std::move(maze) })) {
+                    return;
+                }
+            }
+        });
+    }
+
+    // Stage 2: solve each maze and render it with its path into a text buffer
+    std::thread solverThread([&]() {
+        MazeSolver solver;
+        while (auto job = solveQueue.pop()) {
+            auto start = Clock::now();
+            CompactPath path = solver.findShortestPath(job->maze, 0, 0, rows - 1, cols - 1);
+
+            std::ostringstream text;
+            text << "Maze " << (job->index + 1) << " of " << mazeCount
+                 << " (seed " << job->seed << ")\n";
+            text << "Shortest path length: " << path.size() << " cells\n";
+            MazeRenderer::renderWithPath(text, job->maze, path, 0, 0, rows - 1, cols - 1);
+            stats.solveMs += elapsedMs(start);
+
+            writeQueue.push(WriteJob{ job->index, text.str() });
+        }
+        writeQueue.close();
+    });
+
+    // Stage 3: write buffers in maze order, holding any that arrive early
+    std::thread writerThread([&]() {
+        std::map<int, std::string> pending;
+        int nextToWrite = 0;
+        while (auto job = writeQueue.pop()) {
+            pending.emplace(job->index, std::move(job->text));
+
+            while (!pending.empty() && pending.begin()->first == nextToWrite) {
+                auto start = Clock::now();
+                const std::string& text = pending.begin()->second;
+                out->write(text.data(), static_cast<std::streamsize>(text.size()));
+                stats.bytesWritten += text.size();
+                stats.mazesWritten++;
+                stats.writeMs += elapsedMs(start);
+
+                pending.erase(pending.begin());
+                nextToWrite++;
+
+                {
+                    std::lock_guard<std::mutex> lock(windowMutex);
+                    written = nextToWrite;
+                }
+                windowOpen.notify_all();
+            }
+        }
+
+        auto start = Clock::now();
+        out->flush();
+        stats.writeMs += elapsedMs(start);
+        if (!*out) {
+            stats.ok = false;
+        }
+    });
+
+    for (auto& thread : generatorThreads) {
+        thread.join();
+    }
+    solveQueue.close();
+    solverThread.join();
+    writerThread.join();
+
+    for (double busy : generateBusy) {
+        stats.generateMs += busy;
+    }
+    stats.wallMs = elapsedMs(wallStart);
+
+    return stats;
+}
+
+unsigned int MazePipeline::mazeSeed(int index) const {
+    unsigned int seed = config.seed + static_cast<unsigned int>(index);
+    if (seed == 0) {
+        // 0 would mean "seed from the clock"; the base seed minus one is never
+        // reached by any other index in the batch, so it stays unique
+        seed = config.seed - 1;
+    }
+    return seed;
+}
@@ -0,0 +1,79 @@
+#ifndef MAZE_PIPELINE_H
+#define MAZE_PIPELINE_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @struct PipelineConfig
+ * @brief Settings for a batch run of the maze pipeline
+ */
+struct PipelineConfig {
+    int mazeCount = 1;                 ///< Number of mazes to produce
+    int rows = 21;                     ///< Rows per maze
+    int cols = 21;                     ///< Columns per maze
+    unsigned int seed = 42;            ///< Base seed; maze i uses seed + i, never 0 (0 = random base)
+    unsigned int generatorThreads = 0; ///< Generator stage threads (0 = hardware concurrency)
+    std::size_t queueCapacity = 4;     ///< Maximum mazes waiting between two stages
+    std::string outputPath;            ///< Output file (empty = standard output)
+};
+
+/**
+ * @struct PipelineStats
+ * @brief Timing and volume figures from a pipeline run
+ *
+ * Busy times are summed per stage across its threads, so they can be compared
+ * with the wall time to see how much the stages overlapped.
+ */
+struct PipelineStats {
+    int mazesWritten = 0;
+    std::size_t bytesWritten = 0;
+    double wallMs = 0.0;
+    double generateMs = 0.0;
+    double solveMs = 0.0;
+    double writeMs = 0.0;
+    bool ok = true; ///< false if the output could not be opened or written
+};
+
+/**
+ * @class MazePipeline
+ * @brief Generates, solves, renders and writes mazes as overlapping stages
+ *
+ * Runs three stages connected by bounded queues:
+ * 1. Generator threads build mazes, each from its own seed
+ * 2. A solver thread finds the shortest path and renders the maze to a text buffer
+ * 3. A writer thread writes finished buffers to the output in maze order
+ *
+ * Generators may only start a maze that is within a fixed window of the next
+ * one to write, so memory stays bounded even when mazes finish out of order.
+ *
+ * While one maze is being written, the next ones are already being generated
+ * and solved, so total time approaches that of the slowest stage rather than
+ * the sum of all stages.
+ */
+class MazePipeline {
+public:
+    /**
+     * @brief Constructor for the pipeline
+     * @param config Batch settings
+     */
+    explicit MazePipeline(const PipelineConfig& config);
+
+    /**
+     * @brief Run the whole batch and wait for all stages to finish
+     * @return Timing and volume statistics
+     */
+    PipelineStats run();
+
+private:
+    PipelineConfig config;
+
+    /**
+     * @brief Get the generator seed for one maze of the batch
+     * @param index Maze index within the batch
+     * @return Base seed plus index, remapped so it is never 0 (the "random" seed)
+     */
+    unsigned int mazeSeed(int index) const;
+};
+
+#endif // MAZE_PIPELINE_H
@@ -0,0 +1,274 @@
+#include "MazePostProcessor.h"
+#include "Hash.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+// Directions: up, down, left, right
+const int directions[4][2] = { {-1, 0}, {1, 0}, {0, -1}, {0, 1} };
+
+} // namespace
+
+MazePostProcessor::MazePostProcessor(unsigned int seed, unsigned int threadCount)
+    : threadCount(threadCount) {
+    if (seed == 0) {
+        // Use current time as seed for randomness
+        seed = static_cast<unsigned int>(
+            std::chrono::system_clock::now().time_since_epoch().count()
+        );
+    }
+    this->seed = seed;
+
+    if (this->threadCount == 0) {
+        this->threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+template <typename Visit>
+std::vector<std::pair<int, int>> MazePostProcessor::scanDeadEnds(const Maze& maze, Visit visit) const {
+    const int rows = maze.getRows();
+    const int cols = maze.getCols();
+
+    // Split rows into strips, never more strips than rows
+    int strips = static_cast<int>(std::min<unsigned int>(threadCount, static_cast<unsigned int>(rows)));
+    if (strips < 1) strips = 1;
+
+    std::vector<std::vector<std::pair<int, int>>> results(strips);
+
+    auto scanStrip = [&](int s) {
+        int firstRow = static_cast<int>(static_cast<long long>(rows) * s / strips);
+        int lastRow = static_cast<int>(static_cast<long long>(rows) * (s + 1) / strips);
+        for (int i = firstRow; i < lastRow; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                if (isDeadEnd(maze, i, j)) {
+                    visit(i, j, results[s]);
+                }
+            }
+        }
+    };
+
+    if (strips == 1) {
+        scanStrip(0);
+        return std::move(results[0]);
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(strips);
+    for (int s = 0; s < strips; ++s) {
+        workers.emplace_back(scanStrip, s);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Concatenate strip results in order
+    std::size_t total = 0;
+    for (const auto& part : results) {
+        total += part.size();
+    }
+    std::vector<std::pair<int, int>> merged;
+    merged.reserve(total);
+    for (const auto& part : results) {
+        merged.insert(merged.end(), part.begin(), part.end());
+    }
+    return merged;
+}
+
+std::vector<std::pair<int, int>> MazePostProcessor::findDeadEnds(const Maze& maze) const {
+    return scanDeadEnds(maze, [](int row, int col, std::vector<std::pair<int, int>>& out) {
+        out.push_back({row, col});
+    });
+}
+
+int MazePostProcessor::braid(Maze& maze, double fraction) const {
+    const int cols = maze.getCols();
+
+    // Pass 1 (parallel, read-only): pick a wall for each selected dead end
+    std::vector<std::pair<int, int>> walls = scanDeadEnds(maze,
+        [&](int row, int col, std::vector<std::pair<int, int>>& out) {
+            std::size_t index = static_cast<std::size_t>(row) * cols + col;
+            int wallRow, wallCol;
+            if (isSelected(index, fraction) && chooseWall(maze, row, col, wallRow, wallCol)) {
+                out.push_back({wallRow, wallCol});
+            }
+        });
+
+    // Pass 2 (serial): open the walls; two dead ends may share the same wall
+    int removed = 0;
+    for (const auto& wall : walls) {
+        if (maze.getCell(wall.first, wall.second).getType() == Cell::WALL) {
+            maze.setCellType(wall.first, wall.second, Cell::PATH);
+            removed++;
+        }
+    }
+
+    return removed;
+}
+
+int MazePostProcessor::cullDeadEnds(Maze& maze, double fraction,
+                                    int startRow, int startCol, int endRow, int endCol) const {
+    const int cols = maze.getCols();
+
+    // Pass 1 (parallel, read-only): trace each selected dead end back to its junction
+    std::vector<std::pair<int, int>> cells = scanDeadEnds(maze,
+        [&](int row, int col, std::vector<std::pair<int, int>>& out) {
+            std::size_t index = static_cast<std::size_t>(row) * cols + col;
+            if (isSelected(index, fraction)) {
+                traceCorridor(maze, row, col, startRow, startCol, endRow, endCol, out);
+            }
+        });
+
+    // Pass 2 (serial): fill the corridors; a corridor joining two dead ends is traced twice
+    int filled = 0;
+    for (const auto& cell : cells) {
+        if (maze.getCell(cell.first, cell.second).getType() == Cell::PATH) {
+            maze.setCellType(cell.first, cell.second, Cell::WALL);
+            filled++;
+        }
+    }
+
+    // Pass 3 (serial): a junction whose other branches were all culled is now
+    // a dead end itself, so keep pruning from it; only cells next to filled
+    // ones can have changed, which keeps this linear in the cells removed
+    std::vector<std::pair<int, int>> pending = std::move(cells);
+    while (!pending.empty()) {
+        std::vector<std::pair<int, int>> next;
+        for (const auto& cell : pending) {
+            for (const auto& dir : directions) {
+                int row = cell.first + dir[0];
+                int col = cell.second + dir[1];
+                if (!maze.isInBounds(row, col) || !isDeadEnd(maze, row, col)) {
+                    continue;
+                }
+
+                std::vector<std::pair<int, int>> corridor;
+                traceCorridor(maze, row, col, startRow, startCol, endRow, endCol, corridor);
+                for (const auto& c : corridor) {
+                    maze.setCellType(c.first, c.second, Cell::WALL);
+                    filled++;
+                    next.push_back(c);
+                }
+            }
+        }
+        pending = std::move(next);
+    }
+
+#ifndef NDEBUG
+    // With every dead end selected, only the start and end may still be dead ends
+    if (fraction >= 1.0) {
+        for (const auto& cell : findDeadEnds(maze)) {
+            assert((cell.first == startRow && cell.second == startCol) ||
+                   (cell.first == endRow && cell.second == endCol));
+        }
+    }
+#endif
+
+    return filled;
+}
+
+void MazePostProcessor::traceCorridor(const Maze& maze, int row, int col,
+                                      int startRow, int startCol, int endRow, int endCol,
+                                      std::vector<std::pair<int, int>>& cells) {
+    int prevRow = -1;
+    int prevCol = -1;
+
+    while (true) {
+        if ((row == startRow && col == startCol) || (row == endRow && col == endCol)) {
+            return; // Never cull the endpoints
+        }
+
+        // Find the PATH neighbors other than the cell we came from
+        int pathNeighbors = 0;
+        int nextRow = -1;
+        int nextCol = -1;
+        for (const auto& dir : directions) {
+            int newRow = row + dir[0];
+            int newCol = col + dir[1];
+            if (maze.isInBounds(newRow, newCol) &&
+                maze.getCell(newRow, newCol).getType() == Cell::PATH) {
+                pathNeighbors++;
+                if (newRow != prevRow || newCol != prevCol) {
+                    nextRow = newRow;
+                    nextCol = newCol;
+                }
+            }
+        }
+
+        if (pathNeighbors >= 3) {
+            return; // Reached a junction; it stays
+        }
+
+        cells.push_back({row, col});
+        if (nextRow == -1 || (pathNeighbors == 1 && prevRow != -1)) {
+            return; // Far end of an isolated corridor
+        }
+
+        prevRow = row;
+        prevCol = col;
+        row = nextRow;
+        col = nextCol;
+    }
+}
+
+std::uint64_t MazePostProcessor::cellRandom(std::size_t index, std::uint64_t stream) const {
+    return mix64(mix64(seed ^ (stream << 56)) ^ index);
+}
+
+bool MazePostProcessor::isSelected(std::size_t index, double fraction) const {
+    if (fraction <= 0.0) return false;
+    if (fraction >= 1.0) return true;
+
+    // Compare the top 53 bits against the fraction as a uniform value in [0, 1)
+    double value = static_cast<double>(cellRandom(index, 0) >> 11) * (1.0 / 9007199254740992.0);
+    return value < fraction;
+}
+
+bool MazePostProcessor::isDeadEnd(const Maze& maze, int row, int col) {
+    if (maze.getCell(row, col).getType() != Cell::PATH) {
+        return false;
+    }
+
+    int pathNeighbors = 0;
+    for (const auto& dir : directions) {
+        int newRow = row + dir[0];
+        int newCol = col + dir[1];
+        if (maze.isInBounds(newRow, newCol) &&
+            maze.getCell(newRow, newCol).getType() == Cell::PATH) {
+            pathNeighbors++;
+        }
+    }
+
+    return pathNeighbors == 1;
+}
+
+bool MazePostProcessor::chooseWall(const Maze& maze, int row, int col,
+                                   int& wallRow, int& wallCol) const {
+    int candidates[4];
+    int count = 0;
+
+    for (int d = 0; d < 4; ++d) {
+        int midRow = row + directions[d][0];
+        int midCol = col + directions[d][1];
+        int farRow = row + 2 * directions[d][0];
+        int farCol = col + 2 * directions[d][1];
+
+        if (maze.isInBounds(farRow, farCol) &&
+            maze.getCell(midRow, midCol).getType() == Cell::WALL &&
+            maze.getCell(farRow, farCol).getType() == Cell::PATH) {
+            candidates[count++] = d;
+        }
+    }
+
+    if (count == 0) {
+        return false;
+    }
+
+    std::size_t index = static_cast<std::size_t>(row) * maze.getCols() + col;
+    int d = candidates[cellRandom(index, 1) % count];
+    wallRow = row + directions[d][0];
+    wallCol = col + directions[d][1];
+    return true;
+}
@@ -0,0 +1,135 @@
+#ifndef MAZE_POST_PROCESSOR_H
+#define MAZE_POST_PROCESSOR_H
+
+#include "Maze.h"
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class MazePostProcessor
+ * @brief Post-processing stages that reshape an already generated maze
+ *
+ * Provides two stages that can run after any generator:
+ * - braid: removes dead ends by knocking out a wall, creating loops
+ * - cullDeadEnds: removes dead ends by filling in their corridors with wall
+ *
+ * Each stage makes one linear scan to find dead ends (a PATH cell with exactly
+ * one PATH neighbor) and then applies its edits in a short serial pass. Whether
+ * a dead end is selected depends only on the seed and the cell position, so the
+ * result is identical for any thread count.
+ */
+class MazePostProcessor {
+public:
+    /**
+     * @brief Constructor for the post-processor
+     * @param seed Random seed for reproducibility (0 = random seed)
+     * @param threadCount Number of worker threads for the scan (0 = hardware concurrency)
+     */
+    explicit MazePostProcessor(unsigned int seed = 0, unsigned int threadCount = 1);
+
+    /**
+     * @brief Find all dead ends in the maze
+     * @param maze Reference to the maze to scan
+     * @return Coordinates of every dead end in row-major order
+     */
+    std::vector<std::pair<int, int>> findDeadEnds(const Maze& maze) const;
+
+    /**
+     * @brief Braid the maze by opening a wall at a fraction of its dead ends
+     * @param maze Reference to the maze to modify
+     * @param fraction Fraction of dead ends to remove, from 0.0 to 1.0
+     * @return Number of walls removed
+     */
+    int braid(Maze& maze, double fraction) const;
+
+    /**
+     * @brief Fill in a fraction of the maze's dead ends with wall
+     *
+     * Each selected dead end is filled along its corridor up to the nearest
+     * junction (a cell with three or more PATH neighbors), the start or the end.
+     * A junction left with a single branch is pruned the same way, so with a
+     * fraction of 1.0 no dead ends remain apart from the start and end.
+     *
+     * @param maze Reference to the maze to modify
+     * @param fraction Fraction of dead ends to remove, from 0.0 to 1.0
+     * @param startRow Start cell row (never culled)
+     * @param startCol Start cell column (never culled)
+     * @param endRow End cell row (never culled)
+     * @param endCol End cell column (never culled)
+     * @return Number of cells filled
+     */
+    int cullDeadEnds(Maze& maze, double fraction,
+                     int startRow, int startCol, int endRow, int endCol) const;
+
+private:
+    std::uint64_t seed;
+    unsigned int threadCount;
+
+    /**
+     * @brief Deterministic per-cell random value
+     * @param index Row-major cell index
+     * @param stream Independent stream number for separate decisions on one cell
+     * @return 64-bit pseudo-random value
+     */
+    std::uint64_t cellRandom(std::size_t index, std::uint64_t stream) const;
+
+    /**
+     * @brief Check if a cell is selected for removal
+     * @param index Row-major cell index
+     * @param fraction Selection probability, from 0.0 to 1.0
+     * @return true if the cell is selected
+     */
+    bool isSelected(std::size_t index, double fraction) const;
+
+    /**
+     * @brief Check if a cell is a dead end
+     * @param maze Reference to the maze
+     * @param row Row coordinate
+     * @param col Column coordinate
+     * @return true if the cell is PATH and has exactly one PATH neighbor
+     */
+    static bool isDeadEnd(const Maze& maze, int row, int col);
+
+    /**
+     * @brief Pick the wall to open next to a dead end
+     *
+     * Prefers a wall with a PATH cell directly behind it, so that opening it
+     * joins the dead end to another corridor instead of to solid rock.
+     *
+     * @param maze Reference to the maze
+     * @param row Dead end row
+     * @param col Dead end column
+     * @param wallRow Output: row of the wall to open
+     * @param wallCol Output: column of the wall to open
+     * @return true if a suitable wall was found
+     */
+    bool chooseWall(const Maze& maze, int row, int col, int& wallRow, int& wallCol) const;
+
+    /**
+     * @brief Collect the corridor cells from a dead end up to (not including) its junction
+     * @param maze Reference to the maze
+     * @param row Dead end row
+     * @param col Dead end column
+     * @param startRow Start cell row (stops the walk)
+     * @param startCol Start cell column (stops the walk)
+     * @param endRow End cell row (stops the walk)
+     * @param endCol End cell column (stops the walk)
+     * @param cells Output: cells to fill, appended from the dead end inwards
+     */
+    static void traceCorridor(const Maze& maze, int row, int col,
+                              int startRow, int startCol, int endRow, int endCol,
+                              std::vector<std::pair<int, int>>& cells);
+
+    /**
+     * @brief Scan the maze in horizontal strips, collecting results for each dead end
+     * @param maze Reference to the maze
+     * @param visit Called for each dead end with the strip's output vector to append to
+     * @return Collected coordinates from all strips in row-major order
+     */
+    template <typename Visit>
+    std::vector<std::pair<int, int>> scanDeadEnds(const Maze& maze, Visit visit) const;
+};
+
+#endif // MAZE_POST_PROCESSOR_H
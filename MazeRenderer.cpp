@@ -1,38 +1,56 @@
 #include "MazeRenderer.h"
 #include <iostream>
-#include <algorithm>
+#include <vector>
 
 void MazeRenderer::render(const Maze& maze, int startRow, int startCol, int endRow, int endCol) {
-    std::cout << "\n=== Maze ===\n" << std::endl;
+    render(std::cout, maze, startRow, startCol, endRow, endCol);
+    std::cout << std::flush;
+}
+
+void MazeRenderer::renderWithPath(const Maze& maze, const CompactPath& path,
+                                  int startRow, int startCol, int endRow, int endCol) {
+    renderWithPath(std::cout, maze, path, startRow, startCol, endRow, endCol);
+    std::cout << std::flush;
+}
 
+void MazeRenderer::render(std::ostream& out, const Maze& maze,
+                          int startRow, int startCol, int endRow, int endCol) {
+    out << "\n=== Maze ===\n\n";
+
+    std::string line(maze.getCols() + 1, '\n');
     for (int i = 0; i < maze.getRows(); ++i) {
         for (int j = 0; j < maze.getCols(); ++j) {
             const Cell& cell = maze.getCell(i, j);
-            char ch = getCellChar(cell, i, j, startRow, startCol, endRow, endCol);
-            std::cout << ch;
+            line[j] = getCellChar(cell, i, j, startRow, startCol, endRow, endCol);
         }
-        std::cout << std::endl;
+        out.write(line.data(), static_cast<std::streamsize>(line.size()));
     }
-    std::cout << std::endl;
+    out << '\n';
 }
 
-void MazeRenderer::renderWithPath(const Maze& maze, const std::vector<std::pair<int, int>>& path,
+void MazeRenderer::renderWithPath(std::ostream& out, const Maze& maze, const CompactPath& path,
                                   int startRow, int startCol, int endRow, int endCol) {
-    std::cout << "\n=== Maze with Solution Path (.) ===\n" << std::endl;
+    out << "\n=== Maze with Solution Path (.) ===\n\n";
+
+    // Mark path cells in a bitmap with one walk over the moves
+    const int cols = maze.getCols();
+    std::vector<bool> pathCells(static_cast<std::size_t>(maze.getRows()) * cols, false);
+    for (const auto& cell : path) {
+        pathCells[static_cast<std::size_t>(cell.first) * cols + cell.second] = true;
+    }
 
+    std::string line(cols + 1, '\n');
     for (int i = 0; i < maze.getRows(); ++i) {
-        for (int j = 0; j < maze.getCols(); ++j) {
+        for (int j = 0; j < cols; ++j) {
             const Cell& cell = maze.getCell(i, j);
 
-            // Check if this cell is on the path
-            bool onPath = std::find(path.begin(), path.end(), std::make_pair(i, j)) != path.end();
+            bool onPath = pathCells[static_cast<std::size_t>(i) * cols + j];
 
-            char ch = getCellChar(cell, i, j, startRow, startCol, endRow, endCol, onPath);
-            std::cout << ch;
+            line[j] = getCellChar(cell, i, j, startRow, startCol, endRow, endCol, onPath);
         }
-        std::cout << std::endl;
+        out.write(line.data(), static_cast<std::streamsize>(line.size()));
     }
-    std::cout << std::endl;
+    out << '\n';
 }
 
 char MazeRenderer::getCellChar(const Cell& cell, int row, int col,
@@ -2,9 +2,9 @@
 #define MAZE_RENDERER_H
 
 #include "Maze.h"
+#include "CompactPath.h"
+#include <ostream>
 #include <string>
-#include <vector>
-#include <utility>
 
 /**
  * @class MazeRenderer
@@ -31,13 +31,42 @@ public:
     /**
      * @brief Render the maze with the solution path highlighted
      * @param maze Reference to the maze
-     * @param path Vector of coordinates representing the path
+     * @param path Solution path (walked lazily, never expanded to coordinates)
      * @param startRow Start cell row
      * @param startCol Start cell column
      * @param endRow End cell row
      * @param endCol End cell column
      */
-    static void renderWithPath(const Maze& maze, const std::vector<std::pair<int, int>>& path,
+    static void renderWithPath(const Maze& maze, const CompactPath& path,
+                               int startRow, int startCol, int endRow, int endCol);
+
+    /**
+     * @brief Render the maze to an output stream
+     *
+     * Rows are assembled in memory and written once each, without flushing,
+     * so the stream can be a string buffer or a buffered file.
+     *
+     * @param out Stream to write to
+     * @param maze Reference to the maze to render
+     * @param startRow Start cell row
+     * @param startCol Start cell column
+     * @param endRow End cell row
+     * @param endCol End cell column
+     */
+    static void render(std::ostream& out, const Maze& maze,
+                       int startRow, int startCol, int endRow, int endCol);
+
+    /**
+     * @brief Render the maze with the solution path highlighted to an output stream
+     * @param out Stream to write to
+     * @param maze Reference to the maze
+     * @param path Solution path (walked lazily, never expanded to coordinates)
+     * @param startRow Start cell row
+     * @param startCol Start cell column
+     * @param endRow End cell row
+     * @param endCol End cell column
+     */
+    static void renderWithPath(std::ostream& out, const Maze& maze, const CompactPath& path,
                                int startRow, int startCol, int endRow, int endCol);
 
 private:
@@ -1,12 +1,11 @@
 #include "MazeSolver.h"
 #include <queue>
-#include <algorithm>
 
 bool MazeSolver::isSolvable(Maze& maze, int startRow, int startCol, int endRow, int endCol) {
     // Reset visited flags for the maze
     for (int i = 0; i < maze.getRows(); ++i) {
         for (int j = 0; j < maze.getCols(); ++j) {
-            maze.getCell(i, j).setVisited(false);
+            maze.setCellVisited(i, j, false);
         }
     }
 
@@ -19,7 +18,7 @@ bool MazeSolver::isSolvable(Maze& maze, int startRow, int startCol, int endRow,
     }
 
     q.push({startRow, startCol});
-    maze.getCell(startRow, startCol).setVisited(true);
+    maze.setCellVisited(startRow, startCol, true);
 
     // BFS exploration
     while (!q.empty()) {
@@ -40,7 +39,7 @@ bool MazeSolver::isSolvable(Maze& maze, int startRow, int startCol, int endRow,
             // Check if neighbor is a path and not visited
             if (maze.getCell(nextRow, nextCol).getType() == Cell::PATH &&
                 !maze.getCell(nextRow, nextCol).isVisited()) {
-                maze.getCell(nextRow, nextCol).setVisited(true);
+                maze.setCellVisited(nextRow, nextCol, true);
                 q.push({nextRow, nextCol});
             }
         }
@@ -49,20 +48,40 @@ bool MazeSolver::isSolvable(Maze& maze, int startRow, int startCol, int endRow,
     return false; // No path found
 }
 
-std::vector<std::pair<int, int>> MazeSolver::findShortestPath(
+CompactPath MazeSolver::findShortestPath(
+    Maze& maze, int startRow, int startCol, int endRow, int endCol) {
+
+    if (cache == nullptr) {
+        return searchShortestPath(maze, startRow, startCol, endRow, endCol);
+    }
+
+    // Same layout and endpoints always give the same path
+    SolveKey key = { maze.getContentHash(), startRow, startCol, endRow, endCol };
+    CompactPath path;
+    if (cache->lookup(key, path)) {
+        return path;
+    }
+
+    path = searchShortestPath(maze, startRow, startCol, endRow, endCol);
+    cache->store(key, path);
+    return path;
+}
+
+CompactPath MazeSolver::searchShortestPath(
     Maze& maze, int startRow, int startCol, int endRow, int endCol) {
     
     // Reset visited flags
     for (int i = 0; i < maze.getRows(); ++i) {
         for (int j = 0; j < maze.getCols(); ++j) {
-            maze.getCell(i, j).setVisited(false);
+            maze.setCellVisited(i, j, false);
         }
     }
 
-    // Parent tracking for path reconstruction
-    std::vector<std::vector<std::pair<int, int>>> parent(
-        maze.getRows(),
-        std::vector<std::pair<int, int>>(maze.getCols(), {-1, -1})
+    // Parent tracking for path reconstruction: the move that reached each cell
+    // (1 byte per cell instead of a parent coordinate pair)
+    const int cols = maze.getCols();
+    std::vector<std::uint8_t> parentMove(
+        static_cast<std::size_t>(maze.getRows()) * cols, noParent
     );
 
     std::queue<std::pair<int, int>> q;
@@ -73,10 +92,13 @@ std::vector<std::pair<int, int>> MazeSolver::findShortestPath(
     }
 
     q.push({startRow, startCol});
-    maze.getCell(startRow, startCol).setVisited(true);
+    maze.setCellVisited(startRow, startCol, true);
 
     bool found = false;
 
+    // Directions: up, down, left, right (matching CompactPath::Move codes)
+    const int directions[4][2] = { {-1, 0}, {1, 0}, {0, -1}, {0, 1} };
+
     // BFS exploration with parent tracking
     while (!q.empty() && !found) {
         auto [row, col] = q.front();
@@ -87,46 +109,57 @@ std::vector<std::pair<int, int>> MazeSolver::findShortestPath(
             break;
         }
 
-        std::vector<std::pair<int, int>> neighbors = maze.getNeighbors(row, col);
-        for (const auto& neighbor : neighbors) {
-            int nextRow = neighbor.first;
-            int nextCol = neighbor.second;
+        for (int d = 0; d < 4; ++d) {
+            int nextRow = row + directions[d][0];
+            int nextCol = col + directions[d][1];
 
-            if (maze.getCell(nextRow, nextCol).getType() == Cell::PATH &&
+            if (maze.isInBounds(nextRow, nextCol) &&
+                maze.getCell(nextRow, nextCol).getType() == Cell::PATH &&
                 !maze.getCell(nextRow, nextCol).isVisited()) {
-                maze.getCell(nextRow, nextCol).setVisited(true);
-                parent[nextRow][nextCol] = {row, col};
+                maze.setCellVisited(nextRow, nextCol, true);
+                parentMove[static_cast<std::size_t>(nextRow) * cols + nextCol] =
+                    static_cast<std::uint8_t>(d);
                 q.push({nextRow, nextCol});
             }
         }
     }
 
     if (found) {
-        return reconstructPath(parent, endRow, endCol);
+        return reconstructPath(parentMove, cols, startRow, startCol, endRow, endCol);
     }
 
     return {}; // Empty path if no solution found
 }
 
-std::vector<std::pair<int, int>> MazeSolver::reconstructPath(
-    const std::vector<std::vector<std::pair<int, int>>>& parent,
-    int endRow, int endCol) {
-    
-    std::vector<std::pair<int, int>> path;
+CompactPath MazeSolver::reconstructPath(
+    const std::vector<std::uint8_t>& parentMove, int cols,
+    int startRow, int startCol, int endRow, int endCol) {
 
+    // First pass: count steps by tracing back from end to start
+    std::size_t steps = 0;
     int currentRow = endRow;
     int currentCol = endCol;
-
-    // Trace back from end to start using parent pointers
-    while (currentRow != -1 && currentCol != -1) {
-        path.push_back({currentRow, currentCol});
-        auto [parentRow, parentCol] = parent[currentRow][currentCol];
-        currentRow = parentRow;
-        currentCol = parentCol;
+    while (true) {
+        std::uint8_t move = parentMove[static_cast<std::size_t>(currentRow) * cols + currentCol];
+        if (move == noParent) {
+            break;
+        }
+        currentRow -= CompactPath::rowDelta(static_cast<CompactPath::Move>(move));
+        currentCol -= CompactPath::colDelta(static_cast<CompactPath::Move>(move));
+        steps++;
     }
 
-    // Reverse to get path from start to end
-    std::reverse(path.begin(), path.end());
+    // Second pass: write moves back to front, so no reversal is needed
+    CompactPath path(startRow, startCol, steps);
+    currentRow = endRow;
+    currentCol = endCol;
+    for (std::size_t i = steps; i > 0; --i) {
+        auto move = static_cast<CompactPath::Move>(
+            parentMove[static_cast<std::size_t>(currentRow) * cols + currentCol]);
+        path.setMove(i - 1, move);
+        currentRow -= CompactPath::rowDelta(move);
+        currentCol -= CompactPath::colDelta(move);
+    }
 
     return path;
 }
@@ -2,6 +2,9 @@
 #define MAZE_SOLVER_H
 
 #include "Maze.h"
+#include "SolveCache.h"
+#include "CompactPath.h"
+#include <cstdint>
 #include <vector>
 #include <utility>
 
@@ -11,9 +14,16 @@
  * 
  * Tests whether a path exists from the start cell (top-left) to the end cell (bottom-right).
  * Uses BFS for shortest path finding and complete exploration.
+ * An optional SolveCache lets repeated queries on the same maze skip the BFS.
  */
 class MazeSolver {
 public:
+    /**
+     * @brief Constructor for the solver
+     * @param cache Shortest-path result cache to consult and fill (nullptr = no caching)
+     */
+    explicit MazeSolver(SolveCache* cache = nullptr) : cache(cache) {}
+
     /**
      * @brief Check if the maze is solvable
      * @param maze Reference to the maze to solve
@@ -32,22 +42,42 @@ public:
      * @param startCol Starting column
      * @param endRow Target row
      * @param endCol Target column
-     * @return Vector of coordinates representing the shortest path (empty if no path exists)
+     * @return Shortest path as start cell plus moves (empty if no path exists)
      */
-    std::vector<std::pair<int, int>> findShortestPath(Maze& maze, int startRow, int startCol, 
-                                                       int endRow, int endCol);
+    CompactPath findShortestPath(Maze& maze, int startRow, int startCol,
+                                 int endRow, int endCol);
 
 private:
+    SolveCache* cache;
+
+    // Parent-move marker for cells not reached from a parent (the start cell)
+    static constexpr std::uint8_t noParent = 0xFF;
+
     /**
-     * @brief Reconstruct path from BFS parent tracking
-     * @param parent Map of child -> parent coordinates
+     * @brief Run the BFS for findShortestPath without consulting the cache
+     * @param maze Reference to the maze
+     * @param startRow Starting row
+     * @param startCol Starting column
+     * @param endRow Target row
+     * @param endCol Target column
+     * @return Shortest path as start cell plus moves (empty if no path exists)
+     */
+    CompactPath searchShortestPath(Maze& maze, int startRow, int startCol,
+                                   int endRow, int endCol);
+
+    /**
+     * @brief Reconstruct path from BFS parent-move tracking
+     * @param parentMove Move that reached each cell, row-major (noParent for the start)
+     * @param cols Number of columns in the maze
+     * @param startRow Starting row
+     * @param startCol Starting column
      * @param endRow Target row
      * @param endCol Target column
-     * @return Vector of coordinates representing the path
+     * @return Path written directly in start-to-end order
      */
-    std::vector<std::pair<int, int>> reconstructPath(
-        const std::vector<std::vector<std::pair<int, int>>>& parent,
-        int endRow, int endCol
+    CompactPath reconstructPath(
+        const std::vector<std::uint8_t>& parentMove, int cols,
+        int startRow, int startCol, int endRow, int endCol
     );
 };
 
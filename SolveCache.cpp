@@ -0,0 +1,203 @@
+#include "SolveCache.h"
+#include "Hash.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+// Spill file header tag and version
+const char spillMagic[4] = { 'M', 'Z', 'P', '1' };
+
+} // namespace
+
+std::size_t SolveKeyHash::operator()(const SolveKey& key) const {
+    std::uint64_t h = mix64(key.mazeHash);
+    h = mix64(h ^ ((static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.startRow)) << 32) |
+                   static_cast<std::uint32_t>(key.startCol)));
+    h = mix64(h ^ ((static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.endRow)) << 32) |
+                   static_cast<std::uint32_t>(key.endCol)));
+    return static_cast<std::size_t>(h);
+}
+
+SolveCache::SolveCache(std::size_t capacity, const std::string& spillDirectory)
+    : capacity(capacity), spillDirectory(spillDirectory), hits(0), misses(0) {
+    if (this->capacity == 0) {
+        this->capacity = 1;
+    }
+    if (!this->spillDirectory.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(this->spillDirectory, ec);
+    }
+}
+
+SolveCache::~SolveCache() {
+    flush();
+}
+
+bool SolveCache::lookup(const SolveKey& key, CompactPath& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = index.find(key);
+    if (it != index.end()) {
+        // Move to the front as most recently used
+        entries.splice(entries.begin(), entries, it->second);
+        path = it->second->second;
+        hits++;
+        return true;
+    }
+
+    if (!spillDirectory.empty() && readSpill(key, path)) {
+        insert(key, path);
+        hits++;
+        return true;
+    }
+
+    misses++;
+    return false;
+}
+
+void SolveCache::store(const SolveKey& key, const CompactPath& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = index.find(key);
+    if (it != index.end()) {
+        it->second->second = path;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+
+    insert(key, path);
+}
+
+bool SolveCache::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (spillDirectory.empty()) {
+        return true;
+    }
+
+    bool ok = true;
+    for (const auto& entry : entries) {
+        ok = writeSpill(entry.first, entry.second) && ok;
+    }
+    return ok;
+}
+
+std::size_t SolveCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+std::size_t SolveCache::getHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+std::size_t SolveCache::getMisses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+void SolveCache::insert(const SolveKey& key, CompactPath path) {
+    entries.emplace_front(key, std::move(path));
+    index[key] = entries.begin();
+
+    while (entries.size() > capacity) {
+        const Entry& victim = entries.back();
+        if (!spillDirectory.empty()) {
+            writeSpill(victim.first, victim.second);
+        }
+        index.erase(victim.first);
+        entries.pop_back();
+    }
+}
+
+std::string SolveCache::spillPath(const SolveKey& key) const {
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key.mazeHash << std::dec
+         << '_' << key.startRow << '_' << key.startCol
+         << '_' << key.endRow << '_' << key.endCol << ".path";
+    return (std::filesystem::path(spillDirectory) / name.str()).string();
+}
+
+bool SolveCache::writeSpill(const SolveKey& key, const CompactPath& path) const {
+    std::ofstream out(spillPath(key), std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    // Layout: magic, found flag, start row/col, step count, then the packed moves as-is
+    unsigned char found = path.empty() ? 0 : 1;
+    std::int32_t startRow = path.empty() ? key.startRow : path.getStartRow();
+    std::int32_t startCol = path.empty() ? key.startCol : path.getStartCol();
+    std::uint64_t steps = path.getStepCount();
+    const std::vector<std::uint8_t>& moves = path.getPackedMoves();
+
+    out.write(spillMagic, sizeof(spillMagic));
+    out.write(reinterpret_cast<const char*>(&found), sizeof(found));
+    out.write(reinterpret_cast<const char*>(&startRow), sizeof(startRow));
+    out.write(reinterpret_cast<const char*>(&startCol), sizeof(startCol));
+    out.write(reinterpret_cast<const char*>(&steps), sizeof(steps));
+    out.write(reinterpret_cast<const char*>(moves.data()), static_cast<std::streamsize>(moves.size()));
+
+    return static_cast<bool>(out);
+}
+
+bool SolveCache::readSpill(const SolveKey& key, CompactPath& path) const {
+    std::ifstream in(spillPath(key), std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    char magic[4];
+    unsigned char found = 0;
+    std::int32_t startRow = 0;
+    std::int32_t startCol = 0;
+    std::uint64_t steps = 0;
+
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&found), sizeof(found));
+    in.read(reinterpret_cast<char*>(&startRow), sizeof(startRow));
+    in.read(reinterpret_cast<char*>(&startCol), sizeof(startCol));
+    in.read(reinterpret_cast<char*>(&steps), sizeof(steps));
+    if (!in || !std::equal(magic, magic + 4, spillMagic) || found > 1) {
+        return false;
+    }
+
+    // Reject a file whose start does not belong to this key (e.g. a hash collision)
+    if (startRow != key.startRow || startCol != key.startCol) {
+        return false;
+    }
+
+    // The packed moves must fill the rest of the file exactly; checking against the
+    // real length first keeps a corrupt step count from overflowing or over-allocating
+    std::streamoff headerEnd = in.tellg();
+    in.seekg(0, std::ios::end);
+    std::streamoff remaining = in.tellg() - headerEnd;
+    in.seekg(headerEnd);
+    if (!in || remaining < 0 ||
+        steps > static_cast<std::uint64_t>(remaining) * 4 ||
+        (steps + 3) / 4 != static_cast<std::uint64_t>(remaining)) {
+        return false;
+    }
+
+    if (!found) {
+        if (steps != 0) {
+            return false;
+        }
+        path = CompactPath();
+        return true;
+    }
+
+    std::vector<std::uint8_t> moves(static_cast<std::size_t>(remaining));
+    in.read(reinterpret_cast<char*>(moves.data()), static_cast<std::streamsize>(moves.size()));
+    if (!in) {
+        return false;
+    }
+
+    path = CompactPath(startRow, startCol, steps, std::move(moves));
+    return true;
+}
@@ -0,0 +1,136 @@
+#ifndef SOLVE_CACHE_H
+#define SOLVE_CACHE_H
+
+#include "CompactPath.h"
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * @struct SolveKey
+ * @brief Identifies one solve query: a maze layout plus a start/end pair
+ */
+struct SolveKey {
+    std::uint64_t mazeHash; ///< Maze::getContentHash() of the solved maze
+    int startRow;
+    int startCol;
+    int endRow;
+    int endCol;
+
+    bool operator==(const SolveKey& other) const {
+        return mazeHash == other.mazeHash &&
+               startRow == other.startRow && startCol == other.startCol &&
+               endRow == other.endRow && endCol == other.endCol;
+    }
+};
+
+/**
+ * @struct SolveKeyHash
+ * @brief Hash functor for using SolveKey in unordered containers
+ */
+struct SolveKeyHash {
+    std::size_t operator()(const SolveKey& key) const;
+};
+
+/**
+ * @class SolveCache
+ * @brief LRU cache of shortest-path results keyed by maze hash and endpoints
+ *
+ * Keeps up to a fixed number of paths in memory. When a spill directory is
+ * given, evicted entries are written to disk as the CompactPath encoding (start
+ * coordinate plus 2 bits per step) and are reloaded on a later miss, so results
+ * survive eviction and, after flush(), process restarts.
+ *
+ * All public methods are safe to call from multiple threads.
+ */
+class SolveCache {
+public:
+    /**
+     * @brief Constructor for the cache
+     * @param capacity Maximum number of paths kept in memory
+     * @param spillDirectory Directory for evicted entries (empty = no disk spill)
+     */
+    explicit SolveCache(std::size_t capacity = 1024, const std::string& spillDirectory = "");
+
+    /**
+     * @brief Destructor; flushes in-memory entries when disk spill is enabled
+     */
+    ~SolveCache();
+
+    SolveCache(const SolveCache&) = delete;
+    SolveCache& operator=(const SolveCache&) = delete;
+
+    /**
+     * @brief Look up a cached path
+     * @param key Query key
+     * @param path Output: the cached path (empty if the maze was unsolvable)
+     * @return true if the query was found in memory or on disk
+     */
+    bool lookup(const SolveKey& key, CompactPath& path);
+
+    /**
+     * @brief Store a path, evicting the least recently used entry if full
+     * @param key Query key
+     * @param path Path to cache (empty for an unsolvable query)
+     */
+    void store(const SolveKey& key, const CompactPath& path);
+
+    /**
+     * @brief Write all in-memory entries to the spill directory
+     * @return true if every entry was written (always true without disk spill)
+     */
+    bool flush();
+
+    // Statistics
+    std::size_t size() const;
+    std::size_t getCapacity() const { return capacity; }
+    std::size_t getHits() const;
+    std::size_t getMisses() const;
+
+private:
+    using Entry = std::pair<SolveKey, CompactPath>;
+
+    std::size_t capacity;
+    std::string spillDirectory;
+    std::list<Entry> entries; // Most recently used at the front
+    std::unordered_map<SolveKey, std::list<Entry>::iterator, SolveKeyHash> index;
+    std::size_t hits;
+    std::size_t misses;
+    mutable std::mutex mutex;
+
+    /**
+     * @brief Insert an entry at the front, evicting from the back if over capacity
+     * @param key Query key
+     * @param path Path to insert
+     */
+    void insert(const SolveKey& key, CompactPath path);
+
+    /**
+     * @brief Build the file name used to spill an entry
+     * @param key Query key
+     * @return Path of the spill file
+     */
+    std::string spillPath(const SolveKey& key) const;
+
+    /**
+     * @brief Write one entry to disk
+     * @param key Query key
+     * @param path Path to write
+     * @return true if the file was written
+     */
+    bool writeSpill(const SolveKey& key, const CompactPath& path) const;
+
+    /**
+     * @brief Read one entry from disk
+     * @param key Query key
+     * @param path Output: the decoded path
+     * @return true if a valid file was found
+     */
+    bool readSpill(const SolveKey& key, CompactPath& path) const;
+};
+
+#endif // SOLVE_CACHE_H
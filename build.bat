@@ -12,7 +12,7 @@ where /q g++
 if %ERRORLEVEL% EQU 0 (
     echo Found g++ compiler
     echo Compiling with g++...
-    g++ -std=c++17 -Wall -Wextra -O2 -o maze_generator.exe main.cpp Cell.cpp Maze.cpp MazeGenerator.cpp MazeSolver.cpp MazeRenderer.cpp
+    g++ -std=c++17 -Wall -Wextra -O2 -o maze_generator.exe main.cpp Cell.cpp Maze.cpp MazeGenerator.cpp MazeSolver.cpp MazeRenderer.cpp MazeAnalyzer.cpp MazePostProcessor.cpp SolveCache.cpp CompactPath.cpp MazePipeline.cpp
     if %ERRORLEVEL% EQU 0 (
         echo Build successful!
         echo.
@@ -27,7 +27,7 @@ where /q clang++
 if %ERRORLEVEL% EQU 0 (
     echo Found clang++ compiler
     echo Compiling with clang++...
-    clang++ -std=c++17 -Wall -Wextra -O2 -o maze_generator.exe main.cpp Cell.cpp Maze.cpp MazeGenerator.cpp MazeSolver.cpp MazeRenderer.cpp
+    clang++ -std=c++17 -Wall -Wextra -O2 -o maze_generator.exe main.cpp Cell.cpp Maze.cpp MazeGenerator.cpp MazeSolver.cpp MazeRenderer.cpp MazeAnalyzer.cpp MazePostProcessor.cpp SolveCache.cpp CompactPath.cpp MazePipeline.cpp
     if %ERRORLEVEL% EQU 0 (
         echo Build successful!
         echo.
@@ -42,7 +42,7 @@ where /q cl.exe
 if %ERRORLEVEL% EQU 0 (
     echo Found MSVC compiler (cl.exe)
     echo Compiling with MSVC...
-    cl.exe /std:c++17 /W4 /O2 /EHsc main.cpp Cell.cpp Maze.cpp MazeGenerator.cpp MazeSolver.cpp MazeRenderer.cpp /Fe:maze_generator.exe
+    cl.exe /std:c++17 /W4 /O2 /EHsc main.cpp Cell.cpp Maze.cpp MazeGenerator.cpp MazeSolver.cpp MazeRenderer.cpp MazeAnalyzer.cpp MazePostProcessor.cpp SolveCache.cpp CompactPath.cpp MazePipeline.cpp /Fe:maze_generator.exe
     if %ERRORLEVEL% EQU 0 (
         echo Build successful!
         echo.
@@ -3,8 +3,70 @@
 #include "MazeGenerator.h"
 #include "MazeSolver.h"
 #include "MazeRenderer.h"
+#include "MazeAnalyzer.h"
+#include "MazePostProcessor.h"
+#include "MazePipeline.h"
 #include <iostream>
 #include <chrono>
+#include <cstdlib>
+#include <string>
+
+/**
+ * @brief Batch mode: generate, solve and write many mazes as overlapping stages
+ *
+ * Usage: maze_generator --pipeline <count> <rows> <cols> [output-file]
+ * Mazes go to the output file (or standard output); the summary goes to stderr.
+ *
+ * @param argc Argument count from main
+ * @param argv Argument vector from main
+ * @return Process exit code
+ */
+static int runPipeline(int argc, char* argv[]) {
+    if (argc < 5) {
+        std::cerr << "Usage: " << argv[0] << " --pipeline <count> <rows> <cols> [output-file]" << std::endl;
+        return 1;
+    }
+
+    PipelineConfig config;
+    config.mazeCount = std::atoi(argv[2]);
+    config.rows = std::atoi(argv[3]);
+    config.cols = std::atoi(argv[4]);
+    if (argc > 5) {
+        config.outputPath = argv[5];
+    }
+
+    // Validate input
+    if (config.mazeCount < 1) {
+        std::cerr << "Error: Maze count must be at least 1" << std::endl;
+        return 1;
+    }
+    if (config.rows < 3 || config.cols < 3) {
+        std::cerr << "Error: Minimum maze size is 3x3" << std::endl;
+        return 1;
+    }
+
+    // Ensure odd dimensions for better maze structure
+    if (config.rows % 2 == 0) config.rows++;
+    if (config.cols % 2 == 0) config.cols++;
+
+    MazePipeline pipeline(config);
+    PipelineStats stats = pipeline.run();
+
+    if (!stats.ok) {
+        std::cerr << "Error: Failed to write output" << std::endl;
+        return 1;
+    }
+
+    std::cerr << "\n=== Pipeline Statistics ===" << std::endl;
+    std::cerr << "Mazes written: " << stats.mazesWritten << std::endl;
+    std::cerr << "Bytes written: " << stats.bytesWritten << std::endl;
+    std::cerr << "Generate time (all threads): " << stats.generateMs << " ms" << std::endl;
+    std::cerr << "Solve + render time: " << stats.solveMs << " ms" << std::endl;
+    std::cerr << "Write time: " << stats.writeMs << " ms" << std::endl;
+    std::cerr << "Wall time: " << stats.wallMs << " ms" << std::endl;
+
+    return 0;
+}
 
 /**
  * @brief Main function: generates, validates, and displays a maze
@@ -15,8 +77,14 @@
  * 3. Verifying solvability using BFS
  * 4. Rendering the maze and solution path to console
  * 5. Clean OOP design with separation of concerns
+ *
+ * Run with --pipeline for non-interactive batch generation (see runPipeline).
  */
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--pipeline") {
+        return runPipeline(argc, argv);
+    }
+
     std::cout << "=== Complex Maze Generator ===" << std::endl;
     std::cout << "A guaranteed-solvable perfect maze with OOP design\n" << std::endl;
 
@@ -114,6 +182,17 @@ int main() {
     std::cout << "Paths: " << pathCount << std::endl;
     std::cout << "Path ratio: " << (100.0 * pathCount / (rows * cols)) << "%" << std::endl;
 
+    // Validate structure with a single connected-component labeling scan
+    MazeAnalyzer analyzer(0); // 0 = use all hardware threads
+    ConnectivityReport report = analyzer.analyze(maze);
+
+    std::cout << "Regions: " << report.regionCount << std::endl;
+    std::cout << "Loops: " << report.loops << std::endl;
+    std::cout << "Perfect maze: " << (report.perfect ? "yes" : "no") << std::endl;
+
+    MazePostProcessor postProcessor(42, 0);
+    std::cout << "Dead ends: " << postProcessor.findDeadEnds(maze).size() << std::endl;
+
     std::cout << "\n=== Legend ===" << std::endl;
     std::cout << "S = Start (top-left)" << std::endl;
     std::cout << "E = End (bottom-right)" << std::endl;